@@ -0,0 +1,86 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "chunk.hh"
+#include "zip.hh"
+
+///
+/// Compares per-element iteration with per-chunk iteration for a memcpy-like and a checksum kernel. Build with
+/// optimizations on: bazel run -c opt //:chunk_benchmark
+///
+
+namespace {
+constexpr size_t kSize = 1 << 24;
+constexpr size_t kIterations = 10;
+constexpr size_t kPageBytes = 4096;
+
+// Written to so the compiler can't throw away the kernels
+volatile uint64_t sink = 0;
+
+template <typename F>
+void run(const std::string &name, F f) {
+    double best_ms = std::numeric_limits<double>::max();
+    for (size_t i = 0; i < kIterations; ++i) {
+        const auto start = std::chrono::steady_clock::now();
+        f();
+        const auto end = std::chrono::steady_clock::now();
+        best_ms = std::min(best_ms, std::chrono::duration<double, std::milli>(end - start).count());
+    }
+    std::cout << name << ": " << best_ms << " ms" << std::endl;
+}
+
+uint64_t checksum(const uint32_t *data, size_t size) { return std::accumulate(data, data + size, uint64_t{0}); }
+}  // namespace
+
+int main() {
+    std::vector<uint32_t> source(kSize);
+    std::iota(source.begin(), source.end(), 0);
+    std::vector<uint32_t> destination(kSize, 0);
+
+    run("copy per element", [&]() {
+        for (auto [src, dst] : it::zip(source, destination)) {
+            dst = src;
+        }
+        sink = destination.back();
+    });
+    run("copy per chunk (4 KiB)", [&]() {
+        // The byte budget is split across both inputs, so double it to copy a page at a time
+        auto chunked = it::chunk_by_bytes(it::zip(source, destination), 2 * kPageBytes);
+        for (auto [src, dst] : chunked) {
+            std::memcpy(dst.data(), src.data(), src.size_bytes());
+        }
+        sink = destination.back();
+    });
+
+    run("checksum per element", [&]() {
+        uint64_t sum = 0;
+        for (const uint32_t &value : source) {
+            sum += value;
+        }
+        sink = sum;
+    });
+    for (size_t chunk_size : {16, 1024, 65536}) {
+        run("checksum per chunk (" + std::to_string(chunk_size) + ")", [&]() {
+            uint64_t sum = 0;
+            for (auto span : it::chunk(source, chunk_size)) {
+                sum += checksum(span.data(), span.size());
+            }
+            sink = sum;
+        });
+    }
+    run("checksum per chunk (4 KiB)", [&]() {
+        uint64_t sum = 0;
+        for (auto span : it::chunk_by_bytes(source, kPageBytes)) {
+            sum += checksum(span.data(), span.size());
+        }
+        sink = sum;
+    });
+    return 0;
+}
@@ -0,0 +1,195 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+
+#include "traits.hh"
+#include "zip.hh"
+
+namespace it {
+namespace detail {
+
+///
+/// @brief Non-owning view of contiguous elements. This stands in for std::span since we only require C++17
+///
+template <typename T>
+struct Span {
+    T *ptr;
+    size_t count;
+
+    using iterator = T *;
+    using const_iterator = const T *;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    iterator begin() const { return ptr; }
+    iterator end() const { return ptr + count; }
+    const_iterator cbegin() const { return ptr; }
+    const_iterator cend() const { return ptr + count; }
+    reverse_iterator rbegin() const { return reverse_iterator{end()}; }
+    reverse_iterator rend() const { return reverse_iterator{begin()}; }
+    const_reverse_iterator crbegin() const { return const_reverse_iterator{cend()}; }
+    const_reverse_iterator crend() const { return const_reverse_iterator{cbegin()}; }
+    T *data() const { return ptr; }
+    size_t size() const { return count; }
+    size_t size_bytes() const { return count * sizeof(T); }
+    bool empty() const { return count == 0; }
+    T &operator[](size_t i) const { return ptr[i]; }
+};
+
+template <typename T>
+struct IsZip : std::false_type {};
+template <typename... Container>
+struct IsZip<Zip<Container...>> : std::true_type {};
+
+template <bool kConst, typename T>
+auto &maybe_const(T &t) {
+    if constexpr (kConst) {
+        return std::as_const(t);
+    } else {
+        return t;
+    }
+}
+
+///
+/// @brief Fetch a pointer to the first element of the container, or a tuple of pointers when the container is a Zip
+///
+template <typename Container>
+auto data_of(Container &container) {
+    if constexpr (IsZip<std::decay_t<Container>>::value) {
+        // Zip holds references, so pass its constness through to each of them
+        constexpr bool kConst = std::is_const_v<Container>;
+        return std::apply([](auto &...el) { return std::make_tuple(data_of(maybe_const<kConst>(el.container))...); },
+                          container.holder);
+    } else {
+        return container.data();
+    }
+}
+
+///
+/// @brief Number of bytes a single index covers, summed across each input if they've been zipped
+///
+template <typename T>
+constexpr size_t element_bytes(T *) {
+    return sizeof(T);
+}
+template <typename... Data>
+constexpr size_t element_bytes(const std::tuple<Data...> &data) {
+    return std::apply([](const auto &...d) { return (element_bytes(d) + ...); }, data);
+}
+
+template <typename T>
+Span<T> make_span(T *data, size_t offset, size_t count) {
+    return {data + offset, count};
+}
+template <typename... Data>
+auto make_span(const std::tuple<Data...> &data, size_t offset, size_t count) {
+    return std::apply([&](const auto &...d) { return std::make_tuple(make_span(d, offset, count)...); }, data);
+}
+
+///
+/// @brief Holds onto the raw data pointer(s) instead of the Chunk itself, so this stays valid as long as the
+/// underlying data does
+///
+template <typename Data>
+struct ChunkIterator {
+    Data data;
+    size_t offset;
+    size_t total;
+    size_t chunk_size;
+
+    ChunkIterator &operator++() {
+        offset += std::min(chunk_size, total - offset);
+        return *this;
+    }
+
+    /// Used by enumerate so the index reported is that of the first element in the chunk
+    size_t enumerate_stride() const { return chunk_size; }
+
+    using difference_type = int;
+    using value_type = decltype(make_span(std::declval<Data>(), 0, 0));
+    using reference = value_type;
+    using pointer = std::add_pointer<value_type>;
+    using iterator_category = std::forward_iterator_tag;
+
+    // NOTE: The last chunk will be smaller if the chunk size doesn't evenly divide the container size
+    reference operator*() const { return make_span(data, offset, std::min(chunk_size, total - offset)); }
+
+    bool operator==(const ChunkIterator &rhs) const { return offset == rhs.offset; }
+    bool operator!=(const ChunkIterator &rhs) const { return offset != rhs.offset; }
+    bool operator<(const ChunkIterator &rhs) const { return offset < rhs.offset; }
+};
+
+/// Accepts a reference or value of a contiguous container (anything with data() and size()) or a Zip of them
+template <typename Container>
+struct Chunk {
+    Chunk(Container container_, size_t chunk_size_)
+        : container{std::forward<Container>(container_)}, chunk_size{chunk_size_} {
+        if (chunk_size == 0) throw std::runtime_error("Chunking with a chunk size of zero!");
+    }
+
+    using iterator = ChunkIterator<decltype(data_of(std::declval<Container &>()))>;
+    using const_iterator =
+        ChunkIterator<decltype(data_of(std::declval<const std::remove_reference_t<Container> &>()))>;
+    // NOTE: Reverse chunking isn't supported, these only exist so chunks can be passed to enumerate and zip
+    using reverse_iterator = void;
+    using const_reverse_iterator = void;
+
+    iterator begin() { return {data_of(container), 0, container.size(), chunk_size}; }
+    iterator end() { return {data_of(container), container.size(), container.size(), chunk_size}; }
+    const_iterator begin() const { return cbegin(); }
+    const_iterator end() const { return cend(); }
+    const_iterator cbegin() const { return {data_of(std::as_const(container)), 0, container.size(), chunk_size}; }
+    const_iterator cend() const {
+        return {data_of(std::as_const(container)), container.size(), container.size(), chunk_size};
+    }
+
+    /// Number of chunks, including a partial one at the end. Written this way so huge chunk sizes don't overflow
+    size_t size() const { return container.size() / chunk_size + (container.size() % chunk_size != 0); }
+
+    Container container;
+    size_t chunk_size;
+};
+
+template <typename Container>
+size_t chunk_size_from_bytes(Container &container, size_t bytes) {
+    // Always make some progress, even if a single element is larger than the requested number of bytes
+    return std::max<size_t>(1, bytes / element_bytes(data_of(container)));
+}
+}  // namespace detail
+
+///
+/// @brief Main interfaces
+///
+/// Yields spans of at most chunk_size contiguous elements (or tuples of spans for zipped inputs). When wrapped in
+/// enumerate, the index is that of the first element in each chunk.
+///
+/// NOTE: Unlike the other interfaces, rvalues are moved into the Chunk so the spans don't outlive their data
+///
+template <typename Container>
+detail::Chunk<Container &> chunk(Container &container, size_t chunk_size) {
+    return {container, chunk_size};
+}
+template <typename Container>
+detail::Chunk<Container> chunk(Container &&container, size_t chunk_size) {
+    return {std::move(container), chunk_size};
+}
+
+///
+/// @brief Same as chunk(), but sized so each chunk covers at most the given number of bytes (for example a cache line
+/// or page). For zipped inputs the bytes are split across all of the inputs.
+///
+template <typename Container>
+detail::Chunk<Container &> chunk_by_bytes(Container &container, size_t bytes) {
+    return {container, detail::chunk_size_from_bytes(container, bytes)};
+}
+template <typename Container>
+detail::Chunk<Container> chunk_by_bytes(Container &&container, size_t bytes) {
+    const size_t chunk_size = detail::chunk_size_from_bytes(container, bytes);
+    return {std::move(container), chunk_size};
+}
+}  // namespace it
@@ -13,7 +13,12 @@ struct EnumerateIterator {
     It element;
 
     EnumerateIterator &operator++() {
-        ++index;
+        // Strided iterators (like chunk) report the index of their first element rather than the number of steps
+        if constexpr (HasEnumerateStride<It>::value) {
+            index += element.enumerate_stride();
+        } else {
+            ++index;
+        }
         ++element;
         return *this;
     }
@@ -1,4 +1,5 @@
 #pragma once
+#include "chunk.hh"
 #include "enumerate.hh"
 #include "reverse.hh"
 #include "zip.hh"
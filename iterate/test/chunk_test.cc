@@ -0,0 +1,206 @@
+#include "chunk.hh"
+
+#include <gtest/gtest.h>
+
+#include <limits>
+#include <vector>
+
+#include "enumerate.hh"
+#include "zip.hh"
+
+namespace {
+struct TestType {
+    size_t i;
+    ~TestType() { i = -1; }  // reset if this gets deconstructed
+};
+struct TestType2 {
+    size_t j;
+    ~TestType2() { j = -1; }  // reset if this gets deconstructed
+};
+
+template <typename T>
+constexpr bool kIsConstRef = std::is_const_v<std::remove_reference_t<T>>;
+
+std::vector<TestType> test_type_vector() { return {{0}, {1}, {2}, {3}, {4}, {5}, {6}}; }
+std::vector<TestType2> test_type2_vector() { return {{100}, {101}, {102}, {103}, {104}, {105}, {106}}; }
+}  // namespace
+
+TEST(Chunk, vector_reference) {
+    auto input = test_type_vector();
+    std::vector<size_t> sizes;
+    size_t expected = 0;
+    for (auto span : it::chunk(input, 3)) {
+        EXPECT_FALSE(kIsConstRef<decltype(span[0])>);
+        sizes.push_back(span.size());
+        for (auto& test_type : span) {
+            EXPECT_EQ(expected++, test_type.i);
+        }
+    }
+    EXPECT_EQ(expected, input.size());
+    EXPECT_EQ(sizes, (std::vector<size_t>{3, 3, 1}));
+}
+
+TEST(Chunk, vector_const_reference) {
+    const auto input = test_type_vector();
+    size_t expected = 0;
+    for (auto span : it::chunk(input, 2)) {
+        EXPECT_TRUE(kIsConstRef<decltype(span[0])>);
+        for (const auto& test_type : span) {
+            EXPECT_EQ(expected++, test_type.i);
+        }
+    }
+    EXPECT_EQ(expected, input.size());
+}
+
+TEST(Chunk, const_chunk) {
+    auto input1 = test_type_vector();
+    auto input2 = test_type2_vector();
+    const auto chunked = it::chunk(input1, 3);
+    for (auto span : chunked) {
+        EXPECT_TRUE(kIsConstRef<decltype(span[0])>);
+    }
+    for (auto [i, span] : it::enumerate(chunked)) {
+        EXPECT_TRUE(kIsConstRef<decltype(span[0])>);
+        EXPECT_EQ(i, span[0].i);
+    }
+
+    const auto zipped = it::chunk(it::zip(input1, input2), 3);
+    for (auto [span1, span2] : zipped) {
+        EXPECT_TRUE(kIsConstRef<decltype(span1[0])>);
+        EXPECT_TRUE(kIsConstRef<decltype(span2[0])>);
+    }
+}
+
+TEST(Chunk, vector_rvalue_reference) {
+    size_t expected = 0;
+    for (auto span : it::chunk(test_type_vector(), 4)) {
+        EXPECT_FALSE(kIsConstRef<decltype(span[0])>);
+        for (auto& test_type : span) {
+            EXPECT_EQ(expected++, test_type.i);
+        }
+    }
+    EXPECT_EQ(expected, test_type_vector().size());
+}
+
+TEST(Chunk, even_and_oversized) {
+    const auto input = test_type_vector();
+    EXPECT_EQ(it::chunk(input, 7).size(), 1);
+    EXPECT_EQ(it::chunk(input, 100).size(), 1);
+    EXPECT_EQ(it::chunk(input, 1).size(), input.size());
+    for (auto span : it::chunk(input, 100)) {
+        EXPECT_EQ(span.size(), input.size());
+    }
+
+    const std::vector<TestType> empty;
+    EXPECT_EQ(it::chunk(empty, 3).size(), 0);
+    for (auto span : it::chunk(empty, 3)) {
+        ADD_FAILURE() << "Unexpected chunk of size " << span.size();
+    }
+}
+
+TEST(Chunk, huge_size) {
+    const auto input = test_type_vector();
+    const size_t huge = std::numeric_limits<size_t>::max();
+    EXPECT_EQ(it::chunk(input, huge).size(), 1);
+    EXPECT_EQ(it::chunk_by_bytes(input, huge).size(), 1);
+
+    size_t count = 0;
+    for (auto span : it::chunk(input, huge)) {
+        EXPECT_EQ(span.size(), input.size());
+        count++;
+    }
+    EXPECT_EQ(count, 1);
+}
+
+TEST(Chunk, zero_size) {
+    const auto input = test_type_vector();
+    EXPECT_THROW(it::chunk(input, 0), std::runtime_error);
+}
+
+TEST(Chunk, enumerate_start_index) {
+    const auto input = test_type_vector();
+    auto chunked = it::chunk(input, 3);
+    std::vector<size_t> starts;
+    for (auto [i, span] : it::enumerate(chunked)) {
+        starts.push_back(i);
+        EXPECT_EQ(i, span[0].i);
+    }
+    EXPECT_EQ(starts, (std::vector<size_t>{0, 3, 6}));
+}
+
+TEST(Chunk, zip) {
+    auto input1 = test_type_vector();
+    const auto input2 = test_type2_vector();
+    size_t count = 0;
+    for (auto [span1, span2] : it::chunk(it::zip(input1, input2), 3)) {
+        EXPECT_FALSE(kIsConstRef<decltype(span1[0])>);
+        EXPECT_TRUE(kIsConstRef<decltype(span2[0])>);
+        ASSERT_EQ(span1.size(), span2.size());
+        for (auto [test_type, test_type2] : it::zip(span1, span2)) {
+            EXPECT_EQ(test_type.i + 100, test_type2.j);
+            count++;
+        }
+    }
+    EXPECT_EQ(count, input1.size());
+}
+
+TEST(Chunk, enumerate_zip) {
+    const auto input1 = test_type_vector();
+    const auto input2 = test_type2_vector();
+    auto chunked = it::chunk(it::zip(input1, input2), 2);
+    for (auto [i, spans] : it::enumerate(chunked)) {
+        const auto& [span1, span2] = spans;
+        EXPECT_EQ(i, span1[0].i);
+        EXPECT_EQ(i + 100, span2[0].j);
+    }
+}
+
+TEST(Chunk, enumerate_zipped_chunks) {
+    const auto input1 = test_type_vector();
+    const auto input2 = test_type2_vector();
+    auto chunked1 = it::chunk(input1, 3);
+    auto chunked2 = it::chunk(input2, 3);
+    auto zipped = it::zip(chunked1, chunked2);
+    std::vector<size_t> starts;
+    for (auto [i, spans] : it::enumerate(zipped)) {
+        const auto& [span1, span2] = spans;
+        starts.push_back(i);
+        EXPECT_EQ(i, span1[0].i);
+        EXPECT_EQ(i + 100, span2[0].j);
+    }
+    EXPECT_EQ(starts, (std::vector<size_t>{0, 3, 6}));
+}
+
+TEST(Chunk, enumerate_zipped_chunks_different_strides) {
+    const auto input1 = test_type_vector();
+    const std::vector<TestType2> input2(9);
+    // Both have 3 chunks, but the element index would be ambiguous
+    auto chunked1 = it::chunk(input1, 3);
+    auto chunked2 = it::chunk(input2, 4);
+    auto zipped = it::zip(chunked1, chunked2);
+    auto enumerated = it::enumerate(zipped);
+    auto begin = enumerated.begin();
+    EXPECT_THROW(++begin, std::runtime_error);
+}
+
+TEST(Chunk, by_bytes) {
+    const std::vector<uint32_t> input(1000, 0);
+    const auto chunked = it::chunk_by_bytes(input, 64);
+    EXPECT_EQ(chunked.chunk_size, 16);
+
+    size_t total = 0;
+    for (auto span : chunked) {
+        EXPECT_LE(span.size_bytes(), 64);
+        total += span.size();
+    }
+    EXPECT_EQ(total, input.size());
+
+    // Even if the element is bigger than the bytes requested, each chunk should have an element
+    EXPECT_EQ(it::chunk_by_bytes(input, 1).chunk_size, 1);
+}
+
+TEST(Chunk, by_bytes_zip) {
+    const std::vector<uint32_t> input1(100, 0);
+    const std::vector<uint64_t> input2(100, 0);
+    EXPECT_EQ(it::chunk_by_bytes(it::zip(input1, input2), 120).chunk_size, 10);
+}
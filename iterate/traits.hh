@@ -1,4 +1,7 @@
+#pragma once
+
 #include <iterator>
+#include <type_traits>
 
 namespace it::detail {
 ///
@@ -14,6 +17,15 @@ using IteratorType = std::conditional_t<std::is_const_v<T>, typename std::decay_
 template <typename T>
 using ReferenceType = typename std::iterator_traits<T>::reference;
 
+///
+/// @brief Detect iterators which opt into enumerate reporting an element index (by exposing enumerate_stride()), for
+/// iterators which advance over more than one element at a time
+///
+template <typename It, typename = void>
+struct HasEnumerateStride : std::false_type {};
+template <typename It>
+struct HasEnumerateStride<It, std::void_t<decltype(std::declval<const It &>().enumerate_stride())>> : std::true_type {};
+
 ///
 /// @brief Wraps a container. This redefines some types (specifically when the container is const) so things play nicely
 ///
@@ -2,6 +2,7 @@
 
 #include <stdexcept>
 #include <tuple>
+#include <type_traits>
 
 #include "traits.hh"
 
@@ -34,6 +35,19 @@ struct ZipIterator {
     using pointer = std::add_pointer<value_type>;
     using iterator_category = std::forward_iterator_tag;
 
+    /// Forwarded so enumerating zipped chunks reports the element index, only exists if one of the iterators is strided
+    template <bool kAnyStrided = (HasEnumerateStride<It>::value || ...)>
+    std::enable_if_t<kAnyStrided, size_t> enumerate_stride() const {
+        static_assert((HasEnumerateStride<It>::value && ...),
+                      "Can't enumerate a zip of strided (like chunk) and non-strided iterators!");
+        const size_t stride = std::get<0>(element).enumerate_stride();
+        auto throw_if_wrong_stride = [stride](const auto &el) {
+            if (el.enumerate_stride() != stride) throw std::runtime_error("Enumerating zip with different strides!");
+        };
+        std::apply([&](const auto &...el) { (throw_if_wrong_stride(el), ...); }, element);
+        return stride;
+    }
+
     bool operator==(const ZipIterator &rhs) const { return element == rhs.element; }
     bool operator!=(const ZipIterator &rhs) const { return element != rhs.element; }
 